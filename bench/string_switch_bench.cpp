@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MATTBOLT.BLOGSPOT.COM
+//  Copyright(C) 2013 Matt Bolt
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at:
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares STRING_SWITCH against an if/strcmp chain and a std::unordered_map lookup
+ * on the same workload: 9 routes plus 1 key that matches none of them.
+ *
+ *   g++ -O2 -std=c++11 -Isrc/bolt/util bench/string_switch_bench.cpp -o string_switch_bench
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "macro_string.h"
+
+static const int ROUNDS = 5000000;
+
+static const char* KEYS[] = {
+    "users", "posts", "comments", "likes", "tags",
+    "search", "login", "logout", "admin", "missing"
+};
+
+static const int KEY_COUNT = sizeof(KEYS) / sizeof(KEYS[0]);
+
+int RouteSwitch(const char* key) {
+    STRING_SWITCH(key,
+        ("users", return 1),
+        ("posts", return 2),
+        ("comments", return 3),
+        ("likes", return 4),
+        ("tags", return 5),
+        ("search", return 6),
+        ("login", return 7),
+        ("logout", return 8),
+        ("admin", return 9))
+
+    return 0;
+}
+
+int RouteStrcmp(const char* key) {
+    if (0 == std::strcmp(key, "users")) return 1;
+    if (0 == std::strcmp(key, "posts")) return 2;
+    if (0 == std::strcmp(key, "comments")) return 3;
+    if (0 == std::strcmp(key, "likes")) return 4;
+    if (0 == std::strcmp(key, "tags")) return 5;
+    if (0 == std::strcmp(key, "search")) return 6;
+    if (0 == std::strcmp(key, "login")) return 7;
+    if (0 == std::strcmp(key, "logout")) return 8;
+    if (0 == std::strcmp(key, "admin")) return 9;
+
+    return 0;
+}
+
+static const std::unordered_map<std::string, int> ROUTES = {
+    { "users", 1 }, { "posts", 2 }, { "comments", 3 }, { "likes", 4 }, { "tags", 5 },
+    { "search", 6 }, { "login", 7 }, { "logout", 8 }, { "admin", 9 }
+};
+
+int RouteMap(const char* key) {
+    std::unordered_map<std::string, int>::const_iterator it = ROUTES.find(key);
+    return it == ROUTES.end() ? 0 : it->second;
+}
+
+/**
+ * Runs ROUNDS passes over every key and prints the elapsed time. The keys are copied
+ * into a local buffer so the compiler can't fold the lookups against the literals.
+ */
+template<class F> void Bench(const char* name, F route) {
+    char keys[KEY_COUNT][16];
+    for (int i = 0; i < KEY_COUNT; ++i) {
+        std::strcpy(keys[i], KEYS[i]);
+    }
+
+    volatile long sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int r = 0; r < ROUNDS; ++r) {
+        for (int i = 0; i < KEY_COUNT; ++i) {
+            sum += route(keys[i]);
+        }
+    }
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-14s %8.1f ms  (checksum %ld)\n", name, elapsed.count(), (long) sum);
+}
+
+int main() {
+    for (int i = 0; i < KEY_COUNT; ++i) {
+        int expected = RouteStrcmp(KEYS[i]);
+        if (RouteSwitch(KEYS[i]) != expected || RouteMap(KEYS[i]) != expected) {
+            std::fprintf(stderr, "route mismatch for \"%s\"\n", KEYS[i]);
+            return 1;
+        }
+    }
+
+    Bench("STRING_SWITCH", RouteSwitch);
+    Bench("if/strcmp", RouteStrcmp);
+    Bench("unordered_map", RouteMap);
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MATTBOLT.BLOGSPOT.COM
+//  Copyright(C) 2013 Matt Bolt
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at:
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOLT_UTIL_MACRO_STRING_H
+    #define BOLT_UTIL_MACRO_STRING_H
+
+    #include <cstring>
+
+    #include "macro_va.h"
+    #include "macro_eval.h"
+
+    //--------------------------------------------------------------------------
+    //
+    //  String Hashing
+    //
+    //--------------------------------------------------------------------------
+
+    namespace bolt { namespace util {
+
+        /**
+         * 64-bit FNV-1a hash of a null terminated string. The single return statement
+         * keeps this a valid C++11 constexpr so string literals hash at compile time.
+         * It recurses once per character, so only use it on literals (see HASH_STR).
+         */
+        constexpr unsigned long long HashString(const char* str,
+            unsigned long long hash = 14695981039346656037ULL)
+        {
+            return *str
+                ? HashString(str + 1, (hash ^ (unsigned char) *str) * 1099511628211ULL)
+                : hash;
+        }
+
+        /**
+         * Iterative version of HashString for runtime keys, which may be of any length.
+         * Produces the same values as HashString.
+         */
+        inline unsigned long long HashStringRuntime(const char* str) {
+            unsigned long long hash = 14695981039346656037ULL;
+            for (; *str; ++str) {
+                hash = (hash ^ (unsigned char) *str) * 1099511628211ULL;
+            }
+            return hash;
+        }
+
+    } }
+
+    /**
+     * This macro definition hashes a string. When passed a literal, the result is a
+     * constant expression and can be used as a case label:
+     *
+     *   case HASH_STR("users"): ...
+     *
+     * Each character is one level of constexpr recursion, so literals are limited by the
+     * compiler's constexpr depth (512 by default on GCC). Hash runtime strings with
+     * HashStringRuntime instead.
+     */
+    #define HASH_STR(STR) (::bolt::util::HashString(STR))
+
+    static_assert(HASH_STR("a") == 0xaf63dc4c8601ec8cULL, "HashString is not FNV-1a");
+
+    //--------------------------------------------------------------------------
+    //
+    //  Switch on String
+    //
+    //--------------------------------------------------------------------------
+
+    /**
+     * This macro definition switches on the hash of a null terminated string KEY. Each
+     * following argument is a parenthesized pair of a string literal and the statement
+     * to execute when KEY matches it. For example:
+     *
+     *   STRING_SWITCH(request.path,
+     *       ("users", return HandleUsers(request)),
+     *       ("posts", return HandlePosts(request)))
+     *
+     *   return HandleNotFound(request);
+     *
+     * Expands to a single switch on the runtime hash of KEY, which has no length limit, and
+     * case labels from HASH_STR on each literal. Each case performs one confirming strcmp,
+     * so only a single string compare is made no matter how many cases exist.
+     *
+     * The matched statement runs after the switch has closed, so break and continue in a
+     * statement apply to the enclosing loop just as they would in an if/strcmp chain. If KEY
+     * doesn't match any case, no statement runs. Code following STRING_SWITCH runs whether
+     * or not a case matched, unless the matched statement leaves the scope (return, break,
+     * continue, ...).
+     *
+     * Two literals that hash to the same value produce duplicate case labels, so a hash
+     * collision fails to compile rather than silently shadowing a case.
+     *
+     * Unlike the rest of these headers, this requires C++11 for constexpr.
+     */
+    #define STRING_SWITCH(KEY, ...)                                                   \
+        {                                                                             \
+            const char* STRING_SWITCH_KEY = (KEY);                                    \
+            unsigned long long STRING_SWITCH_HASH =                                   \
+                ::bolt::util::HashStringRuntime(STRING_SWITCH_KEY);                   \
+            bool STRING_SWITCH_MATCH = false;                                         \
+            switch (STRING_SWITCH_HASH) {                                             \
+                VA_EACH(STRING_CASE, __VA_ARGS__)                                     \
+                default: break;                                                       \
+            }                                                                         \
+            if (STRING_SWITCH_MATCH) {                                                \
+                VA_EACH(STRING_HANDLER, __VA_ARGS__) { }                              \
+            }                                                                         \
+        }
+
+    /**
+     * Unpacks a ("literal", statement) pair and emits the case label and confirming compare.
+     * Used in our for each macro as the NEXT() definition.
+     */
+    #define STRING_CASE(PAIR) STRING_CASE_ PAIR
+    #define STRING_CASE_(STR, ...) \
+        case HASH_STR(STR): STRING_SWITCH_MATCH = (0 == std::strcmp(STRING_SWITCH_KEY, STR)); break;
+
+    /**
+     * Unpacks a ("literal", statement) pair and emits one link of the if/else chain which
+     * runs the matched statement outside of the switch.
+     */
+    #define STRING_HANDLER(PAIR) STRING_HANDLER_ PAIR
+    #define STRING_HANDLER_(STR, ...) \
+        if (HASH_STR(STR) == STRING_SWITCH_HASH) { __VA_ARGS__; } else
+
+#endif
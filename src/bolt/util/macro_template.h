@@ -44,24 +44,34 @@
      */
     #define NS_START(...) NS_START_(NS_T_, NS_T, __VA_ARGS__)
 
-    #if defined(IS_MSVC)
-        #define NS_START_(NEXT, END, ...) APPLY(NS_CHECK(__VA_ARGS__), NEXT, END, __VA_ARGS__)
-        #define NS_CHECK(...) NS_CHECK_(GTE(VA_LENGTH(__VA_ARGS__), 2))               
-        #define NS_CHECK_(INDEX) APPLY(IIF(INDEX), NS_1, NS_N)
-        #define NS_1(NEXT, END, ...) APPLY(END, __VA_ARGS__)
-        #define NS_N(NEXT, END, ...) APPLY(VA_ITERATE, NEXT, END, __VA_ARGS__)
+    /**
+     * C++17 allows nested namespace definitions, namespace a::b::c, which is a much smaller
+     * token stream than one namespace block per argument and needs no closing braces from
+     * NS_END. This is detected from the language standard unless BOLT_HAS_NESTED_NS is
+     * already defined, so a project can build with -DBOLT_HAS_NESTED_NS=0 to keep the
+     * pre-C++17 output identical across mixed-standard builds.
+     */
+    #if !defined(BOLT_HAS_NESTED_NS)
+        #if (defined(__cplusplus) && __cplusplus >= 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+            #define BOLT_HAS_NESTED_NS 1
+        #else
+            #define BOLT_HAS_NESTED_NS 0
+        #endif
+    #endif
+
+    #if BOLT_HAS_NESTED_NS
+        #define NS_START_(NEXT, END, ...) namespace TEMPLATE(NS_JOIN_, NS_JOIN, __VA_ARGS__)
     #else
-        #define NS_START_(NEXT, END, ...) NS_CHECK(__VA_ARGS__)(NEXT, END, __VA_ARGS__)
-        #define NS_CHECK(...) IIF(GTE(VA_LENGTH(__VA_ARGS__), 2))(NS_1, NS_N)
-        #define NS_1(NEXT, END, ...) END(__VA_ARGS__)
-        #define NS_N(NEXT, END, ...) VA_ITERATE(NEXT, END, __VA_ARGS__)
+        #define NS_START_(NEXT, END, ...) TEMPLATE(NEXT, END, __VA_ARGS__)
     #endif
 
     /**
      * This macro definition creates the closing braces for the nested namespaces. It must be called
      * after NS_START, and with the same arguments of NS_START. 
      */
-    #if defined(IS_MSVC)
+    #if BOLT_HAS_NESTED_NS
+        #define NS_END(...)
+    #elif defined(IS_MSVC)
         #define NS_END(...) APPLY(MACRO_LOOKUP, NS_END, VA_DEC(__VA_ARGS__))
     #else
         #define NS_END(...) MACRO_LOOKUP(NS_END, VA_LENGTH_DEC(__VA_ARGS__))    
@@ -69,21 +79,24 @@
     
 
     #define NS_T(T) namespace T
-    #define NS_T_(T) NS_T(T) {
+    #define NS_T_(T) NS_T(T){
+
+    #define NS_JOIN(T) T
+    #define NS_JOIN_(T) T::
 
     //--------------------------------
     //  Namespace closing braces
     //--------------------------------
     #define NS_END0
-    #define NS_END1 };
-    #define NS_END2 }; };
-    #define NS_END3 }; }; };
-    #define NS_END4 }; }; }; };
-    #define NS_END5 }; }; }; }; };
-    #define NS_END6 }; }; }; }; }; };
-    #define NS_END7 }; }; }; }; }; }; }; 
-    #define NS_END8 }; }; }; }; }; }; }; };
-    #define NS_END9 }; }; }; }; }; }; }; }; };
+    #define NS_END1 }
+    #define NS_END2 }}
+    #define NS_END3 }}}
+    #define NS_END4 }}}}
+    #define NS_END5 }}}}}
+    #define NS_END6 }}}}}}
+    #define NS_END7 }}}}}}}
+    #define NS_END8 }}}}}}}}
+    #define NS_END9 }}}}}}}}}
 
     //--------------------------------------------------------------------------
     //
@@ -142,22 +155,29 @@
     #define struct(...) generic(__VA_ARGS__) struct
 
     /**
-     * Determines whether or not the variadic arguments have enough elements to be processed. 
-     * If the length is 1, then only the END() macro is executed on the parameter. If the length
-     * is two or more, the foreach is executed.
+     * Executes the NEXT() macro on each of the first N-1 arguments and the END() macro on the
+     * final argument. The argument count selects an unrolled TEMPLATEn definition directly,
+     * so no B_EVAL loop is needed to build the list.
      */
     #if defined(IS_MSVC)
-        #define TEMPLATE(NEXT, END, ...) APPLY(TEMPLATE_CHECK(__VA_ARGS__), NEXT, END, __VA_ARGS__)
-        #define TEMPLATE_CHECK(...) TEMPLATE_CHECK_(GTE(VA_LENGTH(__VA_ARGS__), 2))
-        #define TEMPLATE_CHECK_(INDEX) APPLY(IIF(INDEX), TEMPLATE_1, TEMPLATE_N)
-        #define TEMPLATE_1(NEXT, END, ...) APPLY(END, __VA_ARGS__)
-        #define TEMPLATE_N(NEXT, END, ...) APPLY(VA_ITERATE, NEXT, END, __VA_ARGS__)
+        #define TEMPLATE(NEXT, END, ...) APPLY(MACRO_LOOKUP(TEMPLATE, VA_LENGTH(__VA_ARGS__)), NEXT, END, __VA_ARGS__)
     #else
-        #define TEMPLATE(NEXT, END, ...) TEMPLATE_CHECK(__VA_ARGS__)(NEXT, END, ## __VA_ARGS__)
-        #define TEMPLATE_CHECK(...) IIF(GTE(VA_LENGTH(__VA_ARGS__), 2))(TEMPLATE_1, TEMPLATE_N)
-        #define TEMPLATE_1(NEXT, END, ...) END(__VA_ARGS__)
-        #define TEMPLATE_N(NEXT, END, ...) VA_ITERATE(NEXT, END, __VA_ARGS__)
+        #define TEMPLATE(NEXT, END, ...) MACRO_LOOKUP(TEMPLATE, VA_LENGTH(__VA_ARGS__))(NEXT, END, __VA_ARGS__)
     #endif
+
+    //--------------------------------
+    //  Unrolled TEMPLATE for 10 Params
+    //--------------------------------
+    #define TEMPLATE1(N, E, X0)E(X0)
+    #define TEMPLATE2(N, E, X0, X1)N(X0)E(X1)
+    #define TEMPLATE3(N, E, X0, X1, X2)N(X0)N(X1)E(X2)
+    #define TEMPLATE4(N, E, X0, X1, X2, X3)N(X0)N(X1)N(X2)E(X3)
+    #define TEMPLATE5(N, E, X0, X1, X2, X3, X4)N(X0)N(X1)N(X2)N(X3)E(X4)
+    #define TEMPLATE6(N, E, X0, X1, X2, X3, X4, X5)N(X0)N(X1)N(X2)N(X3)N(X4)E(X5)
+    #define TEMPLATE7(N, E, X0, X1, X2, X3, X4, X5, X6)N(X0)N(X1)N(X2)N(X3)N(X4)N(X5)E(X6)
+    #define TEMPLATE8(N, E, X0, X1, X2, X3, X4, X5, X6, X7)N(X0)N(X1)N(X2)N(X3)N(X4)N(X5)N(X6)E(X7)
+    #define TEMPLATE9(N, E, X0, X1, X2, X3, X4, X5, X6, X7, X8)N(X0)N(X1)N(X2)N(X3)N(X4)N(X5)N(X6)N(X7)E(X8)
+    #define TEMPLATE10(N, E, X0, X1, X2, X3, X4, X5, X6, X7, X8, X9)N(X0)N(X1)N(X2)N(X3)N(X4)N(X5)N(X6)N(X7)N(X8)E(X9)
     
     /**
      * Returns class T. Used in our for each macro as the END() defintion.
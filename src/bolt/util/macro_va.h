@@ -229,8 +229,8 @@
     #if defined(IS_MSVC)
         #define VA_EACH(NEXT, ARG1, ...) APPLY(VA_EACH_EXEC__, NEXT, ARG1, __VA_ARGS__)
     #else
-        #define VA_EACH(NEXT, ARG1, ...) VA_EACH_(NEXT, ARG1, __VA_ARGS__)
-        #define VA_EACH_(NEXT, ...) VA_EACH_EXEC(NEXT, VA_LENGTH(__VA_ARGS__), __VA_ARGS__)
+        #define VA_EACH(NEXT, ARG1, ...) VA_EACH_(NEXT, ARG1, ## __VA_ARGS__)
+        #define VA_EACH_(NEXT, ...) _EACH(NEXT, __VA_ARGS__)
     #endif
 
 
@@ -0,0 +1,137 @@
+#!/usr/bin/env bash
+################################################################################
+#
+#  MATTBOLT.BLOGSPOT.COM
+#  Copyright(C) 2013 Matt Bolt
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at:
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+################################################################################
+#
+# Measures the preprocessed (g++ -E -P) output size and preprocessing time of a
+# generated TU full of NS_START/NS_END, class(...), generic(...) and struct(...),
+# under -std=c++11, -std=c++17 and -std=c++17 -DBOLT_HAS_NESTED_NS=0. Each output
+# is then compiled with -fsyntax-only, and the current tree's output is checked for
+# the expected namespace and template emission.
+#
+# Pass a git revision to measure that revision's headers as well, for a before and
+# after comparison:
+#
+#   test/preprocess_size.sh            # current tree only
+#   test/preprocess_size.sh HEAD~3     # HEAD~3 and the current tree
+#
+# Environment: CXX (default g++), BLOCKS (default 300), RUNS (default 5).
+#
+################################################################################
+
+set -eu
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+CXX="${CXX:-g++}"
+BLOCKS="${BLOCKS:-300}"
+RUNS="${RUNS:-5}"
+BASE_REV="${1:-}"
+
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+FAILED=0
+
+fail() {
+    echo "FAIL: $*" >&2
+    FAILED=1
+}
+
+# Writes the fixture TU: BLOCKS namespaces, each holding a class, method and struct template.
+generate_fixture() {
+    echo '#include "macro_template.h"'
+    for ((i = 0; i < BLOCKS; i++)); do
+        echo "NS_START(bolt, geom$i, detail) {"
+        echo "  class(T, E, U=int) V$i { T x; };"
+        echo "  generic(T) T f$i(T t) { return t; }"
+        echo "  struct(A, B, C, D, E, F) S$i {};"
+        echo "};"
+        echo "NS_END(bolt, geom$i, detail)"
+    done
+}
+
+now_ns() {
+    date +%s%N
+}
+
+# measure <label> <include dir> <flags...>: prints bytes and average -E time, then
+# leaves the preprocessed output in $WORK/out.ii.
+measure() {
+    local label="$1" include="$2"
+    shift 2
+
+    local start end
+    start="$(now_ns)"
+    for ((r = 0; r < RUNS; r++)); do
+        "$CXX" "$@" -E -P -I"$include" "$WORK/fixture.cpp" -o "$WORK/out.ii"
+    done
+    end="$(now_ns)"
+
+    local bytes ms
+    bytes="$(wc -c < "$WORK/out.ii")"
+    ms=$(( (end - start) / RUNS / 1000000 ))
+    printf "%-10s %-36s %8d bytes %6d ms\n" "$label" "$*" "$bytes" "$ms"
+
+    if ! "$CXX" "$@" -fsyntax-only -x c++ "$WORK/out.ii"; then
+        fail "$label $*: preprocessed output does not compile"
+    fi
+}
+
+# expect <pattern> <description>: checks the last preprocessed output for a fixed string.
+expect() {
+    if ! grep -qF -- "$1" "$WORK/out.ii"; then
+        fail "$2: expected '$1'"
+    fi
+}
+
+reject() {
+    if grep -qF -- "$1" "$WORK/out.ii"; then
+        fail "$2: unexpected '$1'"
+    fi
+}
+
+generate_fixture > "$WORK/fixture.cpp"
+
+if [ -n "$BASE_REV" ]; then
+    mkdir -p "$WORK/base"
+    for header in $(git -C "$ROOT" ls-tree --name-only "$BASE_REV" src/bolt/util/); do
+        git -C "$ROOT" show "$BASE_REV:$header" > "$WORK/base/$(basename "$header")"
+    done
+
+    measure "$BASE_REV" "$WORK/base" -std=c++11
+    measure "$BASE_REV" "$WORK/base" -std=c++17
+fi
+
+CURRENT="$ROOT/src/bolt/util"
+
+measure current "$CURRENT" -std=c++11
+expect "namespace bolt{namespace geom0{namespace detail {" "c++11 NS_START"
+expect "}}" "c++11 NS_END"
+reject "};}" "c++11 NS_END"
+expect "template<class T,class E,class U=int> class V0" "class(...)"
+expect "template<class T> T f0" "generic(...)"
+expect "template<class A,class B,class C,class D,class E,class F> struct S0" "struct(...)"
+
+measure current "$CURRENT" -std=c++17
+expect "namespace bolt::geom0::detail {" "c++17 NS_START"
+reject "}}" "c++17 NS_END"
+
+measure current "$CURRENT" -std=c++17 -DBOLT_HAS_NESTED_NS=0
+expect "namespace bolt{namespace geom0{namespace detail {" "BOLT_HAS_NESTED_NS=0 NS_START"
+
+exit "$FAILED"